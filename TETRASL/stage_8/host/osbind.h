@@ -0,0 +1,18 @@
+/**
+ * @file osbind.h
+ * @brief host stand-ins for the GEMDOS/XBIOS bindings so modules can be compiled natively for host tests.
+ *        Only added to the include path by the host targets in MAKEFILE (-Ihost); nothing here touches hardware.
+ * @author Mack Bautista
+ */
+
+#ifndef HOST_OSBIND_H
+#define HOST_OSBIND_H
+
+/*Super() toggles a flag (defined in SUPER.C) and hands out a fake supervisor stack pointer*/
+extern unsigned int host_supervisor;
+#define Super(ssp) ((host_supervisor = !host_supervisor) ? 0x7FF0L : 0L)
+#define Cconis() (0)
+#define Cnecin() (0L)
+#define Vsync()
+
+#endif